@@ -5,6 +5,8 @@
 #include <stdexcept>
 #include <string>
 #include <iostream>
+#include <type_traits>
+#include "MemReserverStats.h"
 
 // Классы исключений
 
@@ -33,7 +35,8 @@ public:
 
 //Шаблонный класс MemReserver
 
-template <typename T, size_t N>
+// WithStats = true включает сбор статистики (см. MemReserverStats.h)
+template <typename T, size_t N, bool WithStats = false>
 class MemReserver {
 private:
     // Структура для хранения одного элемента
@@ -47,6 +50,9 @@ private:
     Slot slots[N];
     size_t active_count = 0;
 
+    using Stats = typename std::conditional<WithStats, MemReserverStats, MemReserverNoStats>::type;
+    Stats statistics;
+
 public:
     MemReserver() = default;
 
@@ -65,6 +71,14 @@ public:
     // Метод create: создает объект in-place
     template <typename... Args>
     T& create(Args&&... args) {
+        // При включенной статистике время замеряется только у выборки вызовов
+        bool timed = false;
+        MemReserverStats::Clock::time_point started;
+        if constexpr (WithStats) {
+            timed = statistics.sample_create();
+            if (timed) started = MemReserverStats::Clock::now();
+        }
+
         // Ищем первый свободный слот
         for (size_t i = 0; i < N; ++i) {
             if (!slots[i].is_active) {
@@ -74,11 +88,19 @@ public:
                 
                 slots[i].is_active = true;
                 active_count++;
+
+                if constexpr (WithStats) {
+                    statistics.on_create(active_count);
+                    if (timed) statistics.record_create_latency(MemReserverStats::Clock::now() - started);
+                }
                 
                 return *reinterpret_cast<T*>(slots[i].data);
             }
         }
         // Если свободного места нет
+        if constexpr (WithStats) {
+            statistics.on_failed_create();
+        }
         throw NotEnoughSlotsError(active_count);
     }
 
@@ -88,11 +110,23 @@ public:
             throw EmptySlotError(index);
         }
 
+        bool timed = false;
+        MemReserverStats::Clock::time_point started;
+        if constexpr (WithStats) {
+            timed = statistics.sample_destroy();
+            if (timed) started = MemReserverStats::Clock::now();
+        }
+
         T* ptr = reinterpret_cast<T*>(slots[index].data);
         ptr->~T(); // Явный вызов деструктора
         
         slots[index].is_active = false;
         active_count--;
+
+        if constexpr (WithStats) {
+            statistics.on_destroy();
+            if (timed) statistics.record_destroy_latency(MemReserverStats::Clock::now() - started);
+        }
     }
 
     // Метод count
@@ -124,4 +158,51 @@ public:
         }
         throw ObjectNotFoundError();
     }
+
+    // Метод stats: снимок статистики (доступен только при WithStats = true)
+    MemReserverStatsSnapshot stats() const {
+        static_assert(WithStats, "Statistics are disabled: use MemReserver<T, N, true>");
+        MemReserverStatsSnapshot snap;
+        snap.capacity = N;
+        snap.in_use = active_count;
+
+        // Фрагментация: ищем самый длинный участок подряд идущих свободных слотов
+        size_t run = 0;
+        for (size_t i = 0; i < N; ++i) {
+            if (slots[i].is_active) {
+                run = 0;
+                continue;
+            }
+            snap.free_count++;
+            run++;
+            if (run > snap.longest_free_run) snap.longest_free_run = run;
+        }
+        if (snap.free_count > 0) {
+            snap.fragmentation = 1.0 - static_cast<double>(snap.longest_free_run) / snap.free_count;
+        }
+
+        statistics.fill(snap);
+        return snap;
+    }
+
+    // Метод set_latency_sample_every: замерять задержку у каждого every-го вызова (1 - у всех, 0 - никогда)
+    void set_latency_sample_every(uint32_t every) {
+        static_assert(WithStats, "Statistics are disabled: use MemReserver<T, N, true>");
+        statistics.set_latency_sample_every(every);
+    }
+
+    // Метод dump_stats: печать снимка статистики в текстовом виде или в JSON
+    void dump_stats(std::ostream& os, MemReserverStats::Format format = MemReserverStats::Format::Text) const {
+        MemReserverStats::print(os, stats(), format);
+    }
+
+    // Метод dump_stats_periodic: печатает статистику, только если с прошлого вывода прошло не меньше period.
+    // Рассчитан на вызов из рабочего цикла. Возвращает true, если вывод был сделан.
+    bool dump_stats_periodic(std::ostream& os, std::chrono::milliseconds period,
+                             MemReserverStats::Format format = MemReserverStats::Format::Text) {
+        static_assert(WithStats, "Statistics are disabled: use MemReserver<T, N, true>");
+        if (!statistics.due(period)) return false;
+        dump_stats(os, format);
+        return true;
+    }
 };
\ No newline at end of file
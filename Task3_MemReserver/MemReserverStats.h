@@ -0,0 +1,227 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// Статистика для MemReserver (включается параметром шаблона WithStats)
+
+// Гистограмма задержек: корзина i содержит замеры длительностью [2^i, 2^(i+1)) наносекунд,
+// корзина 0 также включает замеры короче 1 нс.
+constexpr size_t kLatencyBuckets = 32;
+
+struct LatencyHistogram {
+    std::array<uint64_t, kLatencyBuckets> buckets{};
+
+    uint64_t total() const {
+        uint64_t sum = 0;
+        for (uint64_t b : buckets) sum += b;
+        return sum;
+    }
+
+    // Верхняя граница (в нс) корзины, в которую попадает заданный перцентиль (0..1)
+    uint64_t percentile_ns(double p) const {
+        uint64_t all = total();
+        if (all == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(p * static_cast<double>(all));
+        if (rank >= all) rank = all - 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kLatencyBuckets; ++i) {
+            seen += buckets[i];
+            if (seen > rank) return uint64_t(1) << (i + 1);
+        }
+        return uint64_t(1) << kLatencyBuckets;
+    }
+};
+
+// Снимок статистики на момент вызова stats()
+struct MemReserverStatsSnapshot {
+    size_t capacity = 0;
+    size_t in_use = 0;
+    size_t high_water_mark = 0;
+
+    uint64_t creates = 0;
+    uint64_t destroys = 0;
+    uint64_t failed_creates = 0;     // Сколько раз был брошен NotEnoughSlotsError
+
+    double elapsed_sec = 0;          // Время с начала сбора статистики
+    double create_rate = 0;          // create() в секунду
+    double destroy_rate = 0;         // _delete() в секунду
+
+    // Фрагментация: самый длинный непрерывный участок свободных слотов против общего числа свободных.
+    // 0 - свободные слоты идут одним блоком, ближе к 1 - свободное место "рассыпано" по пулу.
+    size_t free_count = 0;
+    size_t longest_free_run = 0;
+    double fragmentation = 0;
+
+    // Задержки замеряются выборочно: каждый latency_sample_every-й вызов (0 - замеры выключены)
+    uint32_t latency_sample_every = 0;
+    LatencyHistogram create_latency;
+    LatencyHistogram destroy_latency;
+};
+
+// Счетчики статистики.
+// Принадлежат одному MemReserver и, как и сам резервуар, не потокобезопасны.
+// Счетчики вызовов обновляются всегда, а время (steady_clock::now() заметно дороже самого create)
+// замеряется только у каждого sample_every-го вызова.
+class MemReserverStats {
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr uint32_t kDefaultSampleEvery = 64;
+
+private:
+    uint64_t creates = 0;
+    uint64_t destroys = 0;
+    uint64_t failed_creates = 0;
+    size_t high_water_mark = 0;
+    LatencyHistogram create_latency;
+    LatencyHistogram destroy_latency;
+
+    uint32_t sample_every = kDefaultSampleEvery;
+    uint32_t create_countdown = kDefaultSampleEvery;
+    uint32_t destroy_countdown = kDefaultSampleEvery;
+
+    Clock::time_point started_at = Clock::now();
+    Clock::time_point last_dump_at = started_at;
+
+    // Отсчитывает вызовы до следующего замера
+    bool next_sample(uint32_t& countdown) {
+        if (sample_every == 0 || --countdown != 0) return false;
+        countdown = sample_every;
+        return true;
+    }
+
+    static size_t bucket_for(Clock::duration d) {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+        size_t bucket = 0;
+        while (ns > 1 && bucket + 1 < kLatencyBuckets) {
+            ns >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    static void print_histogram(std::ostream& os, const LatencyHistogram& h) {
+        os << "p50<=" << h.percentile_ns(0.5) << "ns"
+           << " p99<=" << h.percentile_ns(0.99) << "ns"
+           << " samples=" << h.total();
+    }
+
+    static void print_histogram_json(std::ostream& os, const LatencyHistogram& h) {
+        os << "{\"p50_ns\":" << h.percentile_ns(0.5)
+           << ",\"p99_ns\":" << h.percentile_ns(0.99)
+           << ",\"buckets\":[";
+        for (size_t i = 0; i < kLatencyBuckets; ++i) {
+            if (i) os << ",";
+            os << h.buckets[i];
+        }
+        os << "]}";
+    }
+
+public:
+    enum class Format { Text, Json };
+
+    MemReserverStats() = default;
+    MemReserverStats(const MemReserverStats&) = delete;
+    MemReserverStats& operator=(const MemReserverStats&) = delete;
+
+    // Частота замеров задержки: 1 - каждый вызов, 0 - не замерять
+    void set_latency_sample_every(uint32_t every) {
+        sample_every = every;
+        create_countdown = every;
+        destroy_countdown = every;
+    }
+
+    // Нужно ли замерять время текущего вызова
+    bool sample_create() { return next_sample(create_countdown); }
+    bool sample_destroy() { return next_sample(destroy_countdown); }
+
+    void on_create(size_t in_use) {
+        creates++;
+        if (in_use > high_water_mark) high_water_mark = in_use;
+    }
+
+    void on_destroy() {
+        destroys++;
+    }
+
+    void on_failed_create() {
+        failed_creates++;
+    }
+
+    void record_create_latency(Clock::duration latency) {
+        create_latency.buckets[bucket_for(latency)]++;
+    }
+
+    void record_destroy_latency(Clock::duration latency) {
+        destroy_latency.buckets[bucket_for(latency)]++;
+    }
+
+    // Заполняет счетчики снимка; поля занятости и фрагментации заполняет сам MemReserver
+    void fill(MemReserverStatsSnapshot& snap) const {
+        snap.creates = creates;
+        snap.destroys = destroys;
+        snap.failed_creates = failed_creates;
+        snap.latency_sample_every = sample_every;
+        snap.create_latency = create_latency;
+        snap.destroy_latency = destroy_latency;
+        snap.high_water_mark = high_water_mark;
+        snap.elapsed_sec = std::chrono::duration<double>(Clock::now() - started_at).count();
+        if (snap.elapsed_sec > 0) {
+            snap.create_rate = static_cast<double>(snap.creates) / snap.elapsed_sec;
+            snap.destroy_rate = static_cast<double>(snap.destroys) / snap.elapsed_sec;
+        }
+    }
+
+    // Периодический вывод: возвращает true, если с прошлого вывода прошло не меньше period
+    bool due(Clock::duration period) {
+        Clock::time_point now = Clock::now();
+        if (now - last_dump_at < period) return false;
+        last_dump_at = now;
+        return true;
+    }
+
+    static void print(std::ostream& os, const MemReserverStatsSnapshot& s, Format format) {
+        if (format == Format::Json) {
+            os << "{\"capacity\":" << s.capacity
+               << ",\"in_use\":" << s.in_use
+               << ",\"high_water_mark\":" << s.high_water_mark
+               << ",\"creates\":" << s.creates
+               << ",\"destroys\":" << s.destroys
+               << ",\"failed_creates\":" << s.failed_creates
+               << ",\"elapsed_sec\":" << s.elapsed_sec
+               << ",\"create_rate\":" << s.create_rate
+               << ",\"destroy_rate\":" << s.destroy_rate
+               << ",\"free_count\":" << s.free_count
+               << ",\"longest_free_run\":" << s.longest_free_run
+               << ",\"fragmentation\":" << s.fragmentation
+               << ",\"latency_sample_every\":" << s.latency_sample_every
+               << ",\"create_latency\":";
+            print_histogram_json(os, s.create_latency);
+            os << ",\"destroy_latency\":";
+            print_histogram_json(os, s.destroy_latency);
+            os << "}\n";
+            return;
+        }
+
+        os << "MemReserver stats:\n"
+           << "  in use:         " << s.in_use << "/" << s.capacity
+           << " (high water mark " << s.high_water_mark << ")\n"
+           << "  creates:        " << s.creates << " (" << s.create_rate << "/s)\n"
+           << "  destroys:       " << s.destroys << " (" << s.destroy_rate << "/s)\n"
+           << "  failed creates: " << s.failed_creates << "\n"
+           << "  free slots:     " << s.free_count << " (longest run " << s.longest_free_run
+           << ", fragmentation " << s.fragmentation << ")\n"
+           << "  latency sampled 1 in " << s.latency_sample_every << " calls\n"
+           << "  create latency: ";
+        print_histogram(os, s.create_latency);
+        os << "\n  destroy latency: ";
+        print_histogram(os, s.destroy_latency);
+        os << "\n";
+    }
+};
+
+// Пустая заглушка, когда статистика выключена
+struct MemReserverNoStats {};
@@ -61,6 +61,29 @@ int main() {
         std::cout << "EXCEPTION CAUGHT: " << e.what() << "\n";
     }
 
+    // 5. Статистика (резервуар с WithStats = true)
+    {
+        std::cout << "\nStats test\n";
+        MemReserver<int, 4, true> counted;
+        counted.set_latency_sample_every(1); // В демо вызовов мало, замеряем каждый
+        counted.create(1);
+        counted.create(2);
+        counted.create(3);
+        counted._delete(1); // Свободны слоты 1 и 3 -> фрагментация
+        try {
+            counted.create(4);
+            counted.create(5);
+            counted.create(6); // Переполнение, попадет в failed creates
+        } catch (const NotEnoughSlotsError& e) {
+            std::cout << "EXCEPTION CAUGHT: " << e.what() << "\n";
+        }
+        counted._delete(0);
+        counted._delete(2);
+
+        counted.dump_stats(std::cout);
+        counted.dump_stats(std::cout, MemReserverStats::Format::Json);
+    }
+
     std::cout << "End of main (Remaining objects will be destroyed automatically)\n";
     
     std::cout << "\nPress Enter to exit";
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <numeric>
+#include <vector>
+#include "Mask.h"
+
+// Плотность маски (доля единиц) задается самой маской: 1111, 1110, 1010, 1000, 0000.
+// Размеры контейнера задаются аргументом бенчмарка.
+
+static std::vector<int> make_input(size_t size) {
+    std::vector<int> v(size);
+    std::iota(v.begin(), v.end(), 0);
+    return v;
+}
+
+// Базовая линия: копирование входного вектора (входит в замер slice)
+static void BM_Mask_CopyBaseline(benchmark::State& state) {
+    const std::vector<int> input = make_input(state.range(0));
+    for (auto _ : state) {
+        std::vector<int> v = input;
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Mask_CopyBaseline)->Arg(64)->Arg(1024)->Arg(8192);
+
+// slice изменяет контейнер на месте, поэтому каждая итерация работает с копией входа
+static void BM_Mask_Slice(benchmark::State& state, Mask<4> mask) {
+    const std::vector<int> input = make_input(state.range(0));
+    for (auto _ : state) {
+        std::vector<int> v = input;
+        mask.slice(v);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Mask_Transform(benchmark::State& state, Mask<4> mask) {
+    const std::vector<int> input = make_input(state.range(0));
+    for (auto _ : state) {
+        auto result = mask.transform(input, [](int x) { return x * 2; });
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_Mask_SliceAndTransform(benchmark::State& state, Mask<4> mask) {
+    const std::vector<int> input = make_input(state.range(0));
+    for (auto _ : state) {
+        auto result = mask.slice_and_transform(input, [](int x) { return x * 2; });
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define MASK_BENCHMARKS(func)                                                         \
+    BENCHMARK_CAPTURE(func, density_100, Mask<4>(1, 1, 1, 1))->Arg(64)->Arg(1024)->Arg(8192); \
+    BENCHMARK_CAPTURE(func, density_75, Mask<4>(1, 1, 1, 0))->Arg(64)->Arg(1024)->Arg(8192);  \
+    BENCHMARK_CAPTURE(func, density_50, Mask<4>(1, 0, 1, 0))->Arg(64)->Arg(1024)->Arg(8192);  \
+    BENCHMARK_CAPTURE(func, density_25, Mask<4>(1, 0, 0, 0))->Arg(64)->Arg(1024)->Arg(8192);  \
+    BENCHMARK_CAPTURE(func, density_0, Mask<4>(0, 0, 0, 0))->Arg(64)->Arg(1024)->Arg(8192)
+
+MASK_BENCHMARKS(BM_Mask_Slice);
+MASK_BENCHMARKS(BM_Mask_Transform);
+MASK_BENCHMARKS(BM_Mask_SliceAndTransform);
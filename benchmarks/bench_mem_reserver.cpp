@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "MemReserver.h"
+
+// Пул на 256 объектов; аргумент бенчмарка - сколько слотов занято перед замером.
+// create ищет свободный слот линейно, поэтому задержка растет с заполненностью.
+constexpr size_t kPoolSize = 256;
+
+struct Payload {
+    int a, b, c;
+    Payload(int a = 0, int b = 0, int c = 0) : a(a), b(b), c(c) {}
+};
+
+template <bool WithStats>
+static void BM_MemReserver_CreateDestroy(benchmark::State& state) {
+    MemReserver<Payload, kPoolSize, WithStats> reserver;
+    const size_t occupied = static_cast<size_t>(state.range(0));
+    for (size_t i = 0; i < occupied; ++i) {
+        reserver.create();
+    }
+
+    for (auto _ : state) {
+        Payload& obj = reserver.create(1, 2, 3);
+        benchmark::DoNotOptimize(&obj);
+        reserver._delete(occupied);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_MemReserver_CreateDestroy, false)->Arg(0)->Arg(64)->Arg(255);
+BENCHMARK_TEMPLATE(BM_MemReserver_CreateDestroy, true)->Arg(0)->Arg(64)->Arg(255);
+
+// Базовая линия: то же самое через кучу
+static void BM_NewDelete(benchmark::State& state) {
+    std::vector<Payload*> held;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        held.push_back(new Payload());
+    }
+
+    for (auto _ : state) {
+        Payload* obj = new Payload(1, 2, 3);
+        benchmark::DoNotOptimize(obj);
+        delete obj;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (Payload* p : held) delete p;
+}
+BENCHMARK(BM_NewDelete)->Arg(0)->Arg(64)->Arg(255);
+
+// Заполнение и освобождение всего пула
+static void BM_MemReserver_FillDrain(benchmark::State& state) {
+    MemReserver<Payload, kPoolSize> reserver;
+    for (auto _ : state) {
+        for (size_t i = 0; i < kPoolSize; ++i) {
+            benchmark::DoNotOptimize(&reserver.create(1, 2, 3));
+        }
+        for (size_t i = 0; i < kPoolSize; ++i) {
+            reserver._delete(i);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kPoolSize);
+}
+BENCHMARK(BM_MemReserver_FillDrain);
+
+static void BM_NewDelete_FillDrain(benchmark::State& state) {
+    std::vector<Payload*> held(kPoolSize);
+    for (auto _ : state) {
+        for (size_t i = 0; i < kPoolSize; ++i) {
+            held[i] = new Payload(1, 2, 3);
+            benchmark::DoNotOptimize(held[i]);
+        }
+        for (size_t i = 0; i < kPoolSize; ++i) {
+            delete held[i];
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kPoolSize);
+}
+BENCHMARK(BM_NewDelete_FillDrain);
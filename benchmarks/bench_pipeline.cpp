@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include "Pipeline.h"
+
+// Накладные расходы пайплайна по сравнению с прямыми вызовами тех же функций
+
+static auto add_one = [](int x) { return x + 1; };
+static auto twice = [](int x) { return x * 2; };
+static auto square = [](int x) { return x * x; };
+
+static void BM_Pipeline_HandWritten(benchmark::State& state) {
+    int value = 5;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        int result = square(twice(add_one(value)));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Pipeline_HandWritten);
+
+// Пайплайн строится и запускается явно на каждой итерации
+static void BM_Pipeline_Explicit(benchmark::State& state) {
+    int value = 5;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        auto pipeline = value | add_one | twice | square;
+        int result = pipeline();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Pipeline_Explicit);
+
+// Немедленное выполнение временного пайплайна в деструкторе
+static void BM_Pipeline_Immediate(benchmark::State& state) {
+    int value = 5;
+    int result = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        value | add_one | twice | square | [&result](int x) { result = x; };
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Pipeline_Immediate);
+
+// Пайплайн над строкой: копирование значения в первый узел тоже входит в замер
+static void BM_Pipeline_String(benchmark::State& state) {
+    std::string str = "Hello World!";
+    for (auto _ : state) {
+        auto pipeline = str | [](const std::string& s) { return s.size(); }
+                            | [](size_t n) { return n * 2; };
+        benchmark::DoNotOptimize(pipeline());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Pipeline_String);
+
+static void BM_String_HandWritten(benchmark::State& state) {
+    std::string str = "Hello World!";
+    for (auto _ : state) {
+        std::string copy = str;
+        benchmark::DoNotOptimize(copy.size() * 2);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_String_HandWritten);
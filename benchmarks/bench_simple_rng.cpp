@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+#include "SimpleRNG.h"
+
+// Генерация значений через итератор: сколько чисел в секунду выдает SimpleRNG
+static void BM_SimpleRNG_Next(benchmark::State& state) {
+    // Параметры, при которых последовательность не сходится к неподвижной точке
+    SimpleRNG generator(2147483647.0, 16807.0, 0.0);
+    generator.reset(1.0);
+    auto it = generator.begin();
+
+    for (auto _ : state) {
+        ++it;
+        benchmark::DoNotOptimize(*it);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimpleRNG_Next);
+
+// Генерация с проверкой конца цикла (it != end), как в range-based for
+static void BM_SimpleRNG_NextWithEndCheck(benchmark::State& state) {
+    SimpleRNG generator(2147483647.0, 16807.0, 0.0);
+    generator.reset(1.0);
+    auto it = generator.begin();
+    auto end = generator.end(1e-9);
+
+    for (auto _ : state) {
+        if (it != end) {
+            ++it;
+        } else {
+            it = generator.begin();
+        }
+        benchmark::DoNotOptimize(*it);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SimpleRNG_NextWithEndCheck);